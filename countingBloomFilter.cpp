@@ -0,0 +1,126 @@
+#include "countingBloomFilter.h"
+#include <cmath>
+#include <functional>
+#include <algorithm>
+#include "hashUtil.h"
+
+template <typename Key>
+CountingBloomFilter<Key>::CountingBloomFilter(size_t expectedKeys, double falsePositiveRate)
+    : keys(0) {
+    if (expectedKeys == 0) expectedKeys = 1;
+    if (falsePositiveRate <= 0.0 || falsePositiveRate >= 1.0) falsePositiveRate = 0.01;
+
+    // Start from the standard size, m = -n ln p / (ln 2)^2 counters, and grow it
+    // until the predicted rate for a blocked layout meets the target. Blocks
+    // receive a Poisson-distributed number of keys, and the overloaded ones
+    // dominate the false positives.
+    const double ln2 = std::log(2.0);
+    double m = -static_cast<double>(expectedKeys) * std::log(falsePositiveRate) / (ln2 * ln2);
+    for (;; m *= 1.05) {
+        double perBlock = expectedKeys * countersPerBlock / m;
+        int bestHashes = 1;
+        double bestRate = 1.0;
+        for (int k = 1; k <= maxHashes; ++k) {
+            double rate = blockedFalsePositiveRate(perBlock, k);
+            if (rate < bestRate) {
+                bestRate = rate;
+                bestHashes = k;
+            }
+        }
+        hashes = bestHashes;
+        if (bestRate <= falsePositiveRate) break;
+    }
+    blocks.assign(static_cast<size_t>(std::ceil(m / countersPerBlock)), Block());
+}
+
+template <typename Key>
+double CountingBloomFilter<Key>::blockedFalsePositiveRate(double keysPerBlock, int hashes) {
+    // Sum over the Poisson distribution of keys landing in the probed block
+    double rate = 0.0;
+    double probability = std::exp(-keysPerBlock);
+    int limit = static_cast<int>(keysPerBlock + 10 * std::sqrt(keysPerBlock) + 10);
+    for (int j = 0; j <= limit; ++j) {
+        if (j > 0) probability *= keysPerBlock / j;
+        double occupied = 1.0 - std::pow(1.0 - 1.0 / countersPerBlock, static_cast<double>(hashes) * j);
+        rate += probability * std::pow(occupied, hashes);
+    }
+    return rate;
+}
+
+template <typename Key>
+size_t CountingBloomFilter<Key>::locate(const Key& key, uint32_t* slots) const {
+    uint64_t h = mixHash(static_cast<uint64_t>(std::hash<Key>{}(key)));
+    size_t block = static_cast<size_t>(((h >> 32) * blocks.size()) >> 32);
+
+    // Further rounds of the mix supply nine independent 7-bit probes each
+    uint64_t bits = 0;
+    for (int i = 0; i < hashes; ++i) {
+        if (i % 9 == 0) {
+            h = mixHash(h);
+            bits = h;
+        }
+        slots[i] = static_cast<uint32_t>(bits) & (countersPerBlock - 1);
+        bits >>= 7;
+    }
+    return block;
+}
+
+template <typename Key>
+uint8_t CountingBloomFilter<Key>::counter(const Block& block, uint32_t i) {
+    return (block.nibbles[i >> 1] >> ((i & 1) * 4)) & 0xF;
+}
+
+template <typename Key>
+void CountingBloomFilter<Key>::setCounter(Block& block, uint32_t i, uint8_t value) {
+    int shift = (i & 1) * 4;
+    block.nibbles[i >> 1] = static_cast<uint8_t>((block.nibbles[i >> 1] & ~(0xF << shift)) | (value << shift));
+}
+
+template <typename Key>
+void CountingBloomFilter<Key>::add(const Key& key) {
+    uint32_t slots[maxHashes];
+    Block& block = blocks[locate(key, slots)];
+    for (int i = 0; i < hashes; ++i) {
+        uint32_t index = slots[i];
+        uint8_t value = counter(block, index);
+        if (value != 0xF) setCounter(block, index, value + 1);
+    }
+    ++keys;
+}
+
+template <typename Key>
+void CountingBloomFilter<Key>::remove(const Key& key) {
+    uint32_t slots[maxHashes];
+    Block& block = blocks[locate(key, slots)];
+    for (int i = 0; i < hashes; ++i) {
+        uint32_t index = slots[i];
+        uint8_t value = counter(block, index);
+        if (value != 0 && value != 0xF) setCounter(block, index, value - 1);
+    }
+    if (keys > 0) --keys;
+}
+
+template <typename Key>
+bool CountingBloomFilter<Key>::mayContain(const Key& key) const {
+    uint32_t slots[maxHashes];
+    const Block& block = blocks[locate(key, slots)];
+    for (int i = 0; i < hashes; ++i) {
+        if (counter(block, slots[i]) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Key>
+void CountingBloomFilter<Key>::clear() {
+    std::fill(blocks.begin(), blocks.end(), Block());
+    keys = 0;
+}
+
+template <typename Key>
+size_t CountingBloomFilter<Key>::memoryUsage() const {
+    return sizeof(*this) + blocks.capacity() * sizeof(Block);
+}
+
+template class CountingBloomFilter<int>;  // Explicit instantiation
@@ -0,0 +1,47 @@
+#ifndef COUNTING_BLOOM_FILTER_H
+#define COUNTING_BLOOM_FILTER_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Blocked Bloom filter with 4-bit counters instead of bits, so keys can be
+// removed again. Each key maps to one 64-byte block (one cache line) and all
+// of its probes land in that block's 128 counters. A negative answer from
+// mayContain() is definite; a positive one may be false at roughly the rate
+// the filter was sized for. Counters that saturate at 15 are never
+// decremented, which keeps answers conservative until the filter is rebuilt.
+template <typename Key>
+class CountingBloomFilter {
+public:
+    CountingBloomFilter(size_t expectedKeys, double falsePositiveRate);
+
+    void add(const Key& key);
+    void remove(const Key& key);
+    bool mayContain(const Key& key) const;
+    void clear();
+
+    size_t keyCount() const { return keys; }
+    size_t memoryUsage() const;
+    int hashCount() const { return hashes; }
+
+private:
+    static const int countersPerBlock = 128;
+    static const int maxHashes = 16;
+
+    struct alignas(64) Block {
+        uint8_t nibbles[64];  // Two 4-bit counters per byte
+    };
+
+    // Index of the key's block; fills slots with the key's counters within it
+    size_t locate(const Key& key, uint32_t* slots) const;
+    static uint8_t counter(const Block& block, uint32_t i);
+    static void setCounter(Block& block, uint32_t i, uint8_t value);
+    static double blockedFalsePositiveRate(double keysPerBlock, int hashes);
+
+    std::vector<Block> blocks;
+    int hashes;
+    size_t keys;
+};
+
+#endif // COUNTING_BLOOM_FILTER_H
@@ -0,0 +1,21 @@
+#ifndef HASH_UTIL_H
+#define HASH_UTIL_H
+
+#include <cstdint>
+#include <cstddef>
+
+// splitmix64 finaliser so that identity hashes (e.g. std::hash<int>) spread out
+inline uint64_t mixHash(uint64_t h) {
+    h += 0x9E3779B97F4A7C15ULL;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return h ^ (h >> 31);
+}
+
+inline size_t roundUpToPowerOfTwo(size_t n) {
+    size_t size = 1;
+    while (size < n) size <<= 1;
+    return size;
+}
+
+#endif // HASH_UTIL_H
@@ -0,0 +1,256 @@
+#include "hotKeys.h"
+#include <algorithm>
+#include <functional>
+#include <string>
+#include "hashUtil.h"
+
+template <typename Key>
+HotKeyTracker<Key>::HotKeyTracker(size_t topK, size_t width, int depth)
+    : width(roundUpToPowerOfTwo(width)), depth(std::max(1, std::min(depth, maxDepth))), capacity(topK),
+      counters(this->width * this->depth, 0), coldest(0),
+      index(roundUpToPowerOfTwo(std::max<size_t>(8, 2 * topK)), 0), recorded(0) {
+    top.reserve(capacity);
+    indexMask = index.size() - 1;
+}
+
+template <typename Key>
+uint64_t HotKeyTracker<Key>::hash(const Key& key) const {
+    return mixHash(static_cast<uint64_t>(std::hash<Key>{}(key)));
+}
+
+template <typename Key>
+size_t HotKeyTracker<Key>::cell(int row, uint64_t h) const {
+    uint32_t h1 = static_cast<uint32_t>(h);
+    uint32_t h2 = static_cast<uint32_t>(h >> 32) | 1;
+    return row * width + ((h1 + row * h2) & (width - 1));
+}
+
+template <typename Key>
+uint32_t HotKeyTracker<Key>::estimate(const Key& key) const {
+    uint64_t h = hash(key);
+    uint32_t count = UINT32_MAX;
+    for (int row = 0; row < depth; ++row) {
+        count = std::min(count, counters[cell(row, h)]);
+    }
+    return count;
+}
+
+template <typename Key>
+size_t HotKeyTracker<Key>::indexFind(const Key& key, uint64_t h) const {
+    size_t i = (h >> 32) & indexMask;
+    while (index[i] != 0 && !(top[index[i] - 1].first == key)) {
+        i = (i + 1) & indexMask;
+    }
+    return i;
+}
+
+template <typename Key>
+void HotKeyTracker<Key>::indexInsert(const Key& key, uint64_t h, size_t slot) {
+    index[indexFind(key, h)] = static_cast<uint32_t>(slot + 1);
+}
+
+template <typename Key>
+void HotKeyTracker<Key>::indexErase(const Key& key, uint64_t h) {
+    // Backward-shift deletion keeps every remaining key reachable from its home bucket
+    size_t hole = indexFind(key, h);
+    if (index[hole] == 0) return;
+    for (size_t i = (hole + 1) & indexMask; index[i] != 0; i = (i + 1) & indexMask) {
+        size_t home = (hash(top[index[i] - 1].first) >> 32) & indexMask;
+        if (((i - home) & indexMask) >= ((i - hole) & indexMask)) {
+            index[hole] = index[i];
+            hole = i;
+        }
+    }
+    index[hole] = 0;
+}
+
+template <typename Key>
+bool HotKeyTracker<Key>::record(const Key& key, Key& evicted, bool& didEvict) {
+    didEvict = false;
+
+    // Conservative update: only raise the counters that hold the minimum
+    uint64_t h = hash(key);
+    size_t cells[maxDepth];
+    uint32_t count = UINT32_MAX;
+    for (int row = 0; row < depth; ++row) {
+        cells[row] = cell(row, h);
+        count = std::min(count, counters[cells[row]]);
+    }
+    ++count;
+    for (int row = 0; row < depth; ++row) {
+        counters[cells[row]] = std::max(counters[cells[row]], count);
+    }
+
+    if (++recorded >= width * 8) {
+        age();
+        count >>= 1;  // Halved like the key's own cells, so sketch, top and count agree
+    }
+
+    uint32_t member = index[indexFind(key, h)];
+    if (member != 0) {
+        top[member - 1].second = count;
+        if (member - 1 == coldest) findColdest();
+        return true;
+    }
+
+    if (top.size() < capacity) {
+        top.emplace_back(key, count);
+        indexInsert(key, h, top.size() - 1);
+        findColdest();
+        return true;
+    }
+
+    if (capacity == 0) return false;
+
+    if (count > top[coldest].second) {
+        evicted = top[coldest].first;
+        didEvict = true;
+        indexErase(evicted, hash(evicted));
+        top[coldest] = std::make_pair(key, count);
+        indexInsert(key, h, coldest);
+        findColdest();
+        return true;
+    }
+    return false;
+}
+
+template <typename Key>
+void HotKeyTracker<Key>::findColdest() {
+    // Counts only grow between agings, so the coldest entry changes only when
+    // it is itself updated or replaced
+    coldest = 0;
+    for (size_t i = 1; i < top.size(); ++i) {
+        if (top[i].second < top[coldest].second) coldest = i;
+    }
+}
+
+template <typename Key>
+void HotKeyTracker<Key>::age() {
+    for (uint32_t& counter : counters) {
+        counter >>= 1;
+    }
+    for (std::pair<Key, uint32_t>& entry : top) {
+        entry.second >>= 1;
+    }
+    recorded = 0;
+}
+
+template <typename Key>
+std::vector<std::pair<Key, uint32_t>> HotKeyTracker<Key>::topK() const {
+    std::vector<std::pair<Key, uint32_t>> result(top);
+    std::sort(result.begin(), result.end(),
+        [](const std::pair<Key, uint32_t>& a, const std::pair<Key, uint32_t>& b) { return a.second > b.second; });
+    return result;
+}
+
+template <typename Key>
+void HotKeyTracker<Key>::clear() {
+    std::fill(counters.begin(), counters.end(), 0);
+    top.clear();
+    std::fill(index.begin(), index.end(), 0);
+    coldest = 0;
+    recorded = 0;
+}
+
+template <typename Key, typename Value>
+HotKeyCache<Key, Value>::HotKeyCache(size_t entries)
+    : slots(roundUpToPowerOfTwo(std::max<size_t>(8, 2 * entries))), used(0) {
+    mask = slots.size() - 1;
+}
+
+template <typename Key, typename Value>
+size_t HotKeyCache<Key, Value>::home(const Key& key) const {
+    return mixHash(static_cast<uint64_t>(std::hash<Key>{}(key))) & mask;
+}
+
+template <typename Key, typename Value>
+size_t HotKeyCache<Key, Value>::find(const Key& key) const {
+    size_t i = home(key);
+    for (size_t probes = 0; probes < slots.size(); ++probes, i = (i + 1) & mask) {
+        const Slot& slot = slots[i];
+        if (slot.state == State::Empty) break;
+        if (slot.state == State::Full && slot.key == key) return i;
+    }
+    return slots.size();
+}
+
+template <typename Key, typename Value>
+bool HotKeyCache<Key, Value>::get(const Key& key, Value& value) const {
+    size_t i = find(key);
+    if (i == slots.size()) return false;
+    value = slots[i].value;
+    return true;
+}
+
+template <typename Key, typename Value>
+void HotKeyCache<Key, Value>::put(const Key& key, const Value& value) {
+    size_t i = find(key);
+    if (i != slots.size()) {
+        slots[i].value = value;
+        return;
+    }
+
+    // Keep at least a quarter of the slots empty so probes terminate quickly
+    if ((used + 1) * 4 > slots.size() * 3) {
+        rehash();
+    }
+
+    i = home(key);
+    while (slots[i].state == State::Full) {
+        i = (i + 1) & mask;
+    }
+    if (slots[i].state == State::Empty) {
+        ++used;
+    }
+    slots[i].key = key;
+    slots[i].value = value;
+    slots[i].state = State::Full;
+}
+
+template <typename Key, typename Value>
+void HotKeyCache<Key, Value>::update(const Key& key, const Value& value) {
+    size_t i = find(key);
+    if (i != slots.size()) {
+        slots[i].value = value;
+    }
+}
+
+template <typename Key, typename Value>
+void HotKeyCache<Key, Value>::erase(const Key& key) {
+    size_t i = find(key);
+    if (i != slots.size()) {
+        slots[i].state = State::Deleted;
+        slots[i].value = Value{};
+    }
+}
+
+template <typename Key, typename Value>
+void HotKeyCache<Key, Value>::rehash() {
+    // Drops tombstones, and grows the table if live entries alone fill a quarter of it
+    size_t live = 0;
+    for (const Slot& slot : slots) {
+        if (slot.state == State::Full) ++live;
+    }
+    std::vector<Slot> old(std::max(slots.size(), roundUpToPowerOfTwo(4 * (live + 1))));
+    old.swap(slots);
+    mask = slots.size() - 1;
+    used = 0;
+    for (Slot& slot : old) {
+        if (slot.state != State::Full) continue;
+        size_t i = home(slot.key);
+        while (slots[i].state == State::Full) {
+            i = (i + 1) & mask;
+        }
+        slots[i] = std::move(slot);
+        ++used;
+    }
+}
+
+template <typename Key, typename Value>
+void HotKeyCache<Key, Value>::clear() {
+    std::fill(slots.begin(), slots.end(), Slot());
+    used = 0;
+}
+
+template class HotKeyTracker<int>;                 // Explicit instantiation
+template class HotKeyCache<int, std::string>;      // Explicit instantiation
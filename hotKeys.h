@@ -0,0 +1,81 @@
+#ifndef HOT_KEYS_H
+#define HOT_KEYS_H
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// Approximate access frequencies from a count-min sketch (with conservative
+// update), plus the top-K keys by estimated count. A small linear-probing
+// index maps keys to their top-K slot so membership is O(1). Counts are
+// halved periodically so the top-K follows shifts in the workload.
+template <typename Key>
+class HotKeyTracker {
+public:
+    HotKeyTracker(size_t topK, size_t width = 4096, int depth = 4);
+
+    // Counts one access to key and returns true if it is in the top-K
+    // afterwards. When another key is pushed out of the top-K to make room,
+    // it is stored in evicted and didEvict is set.
+    bool record(const Key& key, Key& evicted, bool& didEvict);
+    uint32_t estimate(const Key& key) const;
+    std::vector<std::pair<Key, uint32_t>> topK() const;
+    void clear();
+
+private:
+    static constexpr int maxDepth = 16;
+
+    uint64_t hash(const Key& key) const;
+    size_t cell(int row, uint64_t h) const;  // Counter index for one sketch row
+    void age();
+    void findColdest();
+
+    size_t indexFind(const Key& key, uint64_t h) const;  // Position in index, or of the empty slot ending the probe
+    void indexInsert(const Key& key, uint64_t h, size_t slot);
+    void indexErase(const Key& key, uint64_t h);
+
+    size_t width;
+    int depth;
+    size_t capacity;
+    std::vector<uint32_t> counters;  // depth rows of width counters
+    std::vector<std::pair<Key, uint32_t>> top;
+    size_t coldest;  // Index of the lowest count in top
+    std::vector<uint32_t> index;  // top slot + 1 per bucket, 0 when empty
+    size_t indexMask;
+    size_t recorded;
+};
+
+// Small open-addressing (linear probing) table of key/value copies that
+// SkipList::search checks before descending. Erased slots become tombstones
+// and the table is rehashed once they pile up.
+template <typename Key, typename Value>
+class HotKeyCache {
+public:
+    explicit HotKeyCache(size_t entries);
+
+    bool get(const Key& key, Value& value) const;
+    void put(const Key& key, const Value& value);
+    void update(const Key& key, const Value& value);  // Only if already cached
+    void erase(const Key& key);
+    void clear();
+
+private:
+    enum class State : uint8_t { Empty, Full, Deleted };
+
+    struct Slot {
+        Key key{};
+        Value value{};
+        State state = State::Empty;
+    };
+
+    size_t find(const Key& key) const;  // Slot index, or slots.size() if absent
+    size_t home(const Key& key) const;
+    void rehash();
+
+    std::vector<Slot> slots;
+    size_t mask;
+    size_t used;  // Full plus Deleted slots
+};
+
+#endif // HOT_KEYS_H
@@ -0,0 +1,19 @@
+#include "nodeSlab.h"
+
+NodeSlab::NodeSlab(size_t capacity)
+    : data(new char[capacity]), capacity(capacity), used(0), liveNodes(0) {}
+
+void* NodeSlab::allocate(size_t bytes) {
+    const size_t align = alignof(std::max_align_t);
+    size_t offset = (used + align - 1) & ~(align - 1);
+    if (offset + bytes > capacity) {
+        return nullptr;
+    }
+    used = offset + bytes;
+    return data.get() + offset;
+}
+
+bool NodeSlab::owns(const void* p) const {
+    const char* c = static_cast<const char*>(p);
+    return c >= data.get() && c < data.get() + capacity;
+}
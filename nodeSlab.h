@@ -0,0 +1,59 @@
+#ifndef NODE_SLAB_H
+#define NODE_SLAB_H
+
+#include <memory>
+#include <cstddef>
+#include <new>
+
+// Contiguous block that compaction bump-allocates relocated nodes (and their
+// forward arrays) from, so a level-0 walk touches memory in address order.
+// Individual allocations are never freed; the owner releases the whole slab
+// once liveNodes drops to zero.
+struct NodeSlab {
+    explicit NodeSlab(size_t capacity);
+
+    void* allocate(size_t bytes);  // nullptr when the slab is full
+    bool owns(const void* p) const;
+
+    std::unique_ptr<char[]> data;
+    size_t capacity;
+    size_t used;
+    size_t liveNodes;
+};
+
+// Allocator for Node::forward: draws from a slab when one is given and falls
+// back to the global heap otherwise (or when the slab has run out of room).
+template <typename T>
+struct SlabAllocator {
+    using value_type = T;
+
+    SlabAllocator() : slab(nullptr) {}
+    explicit SlabAllocator(NodeSlab* slab) : slab(slab) {}
+    template <typename U>
+    SlabAllocator(const SlabAllocator<U>& other) : slab(other.slab) {}
+
+    T* allocate(size_t n) {
+        if (slab != nullptr) {
+            if (void* p = slab->allocate(n * sizeof(T))) {
+                return static_cast<T*>(p);
+            }
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t) {
+        if (slab == nullptr || !slab->owns(p)) {
+            ::operator delete(p);
+        }
+    }
+
+    NodeSlab* slab;
+};
+
+template <typename T, typename U>
+bool operator==(const SlabAllocator<T>& a, const SlabAllocator<U>& b) { return a.slab == b.slab; }
+
+template <typename T, typename U>
+bool operator!=(const SlabAllocator<T>& a, const SlabAllocator<U>& b) { return a.slab != b.slab; }
+
+#endif // NODE_SLAB_H
@@ -0,0 +1,310 @@
+#include "partitionedSkipList.h"
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+const size_t kQueueCapacity = 1024;
+const int kSpinsBeforeYield = 256;
+const int kYieldsBeforePark = 64;
+
+// Parses a sysfs id list such as "0-3,8-11".
+std::vector<int> parseIdList(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty()) continue;
+        size_t dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+std::string readLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+// CPUs this process may run on (taskset, cpusets), or empty if unknown.
+std::vector<int> allowedCpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+        }
+    }
+#endif
+    return cpus;
+}
+
+void backoff(int& spins) {
+    if (++spins >= kSpinsBeforeYield) {
+        std::this_thread::yield();
+        spins = 0;
+    }
+}
+
+} // namespace
+
+std::vector<std::vector<int>> numaTopology() {
+    std::vector<int> allowed = allowedCpus();
+    if (allowed.empty()) {
+        int count = std::max(1u, std::thread::hardware_concurrency());
+        for (int cpu = 0; cpu < count; ++cpu) {
+            allowed.push_back(cpu);
+        }
+    }
+
+    // Node ids can have gaps, so take them from the online list
+    std::vector<std::vector<int>> nodes;
+    for (int node : parseIdList(readLine("/sys/devices/system/node/online"))) {
+        std::vector<int> cpus;
+        for (int cpu : parseIdList(readLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"))) {
+            if (std::find(allowed.begin(), allowed.end(), cpu) != allowed.end()) {
+                cpus.push_back(cpu);
+            }
+        }
+        if (!cpus.empty()) {
+            nodes.push_back(cpus);
+        }
+    }
+
+    if (nodes.empty()) {
+        nodes.push_back(allowed);
+    }
+    return nodes;
+}
+
+bool pinCurrentThread(const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+template <typename Key, typename Value>
+PartitionedSkipList<Key, Value>::PartitionedSkipList(int maxLevel, PartitionMode mode, int count)
+    : maxLevel(maxLevel) {
+    std::vector<std::vector<int>> nodes = numaTopology();
+
+    // CPU sets for each partition, ordered by node so neighbouring partitions share a node
+    std::vector<std::vector<int>> placements;
+    if (mode == PartitionMode::PerNode) {
+        placements = nodes;
+    } else {
+        for (const std::vector<int>& node : nodes) {
+            for (int cpu : node) {
+                placements.push_back({cpu});
+            }
+        }
+    }
+
+    if (count <= 0) {
+        count = static_cast<int>(placements.size());
+    }
+
+    for (int i = 0; i < count; ++i) {
+        std::unique_ptr<Partition> partition(new Partition(kQueueCapacity));
+        partition->cpus = placements[i % placements.size()];
+        partitions.push_back(std::move(partition));
+    }
+
+    for (std::unique_ptr<Partition>& partition : partitions) {
+        Partition* p = partition.get();
+        p->worker = std::thread([this, p] { run(*p); });
+    }
+    for (std::unique_ptr<Partition>& partition : partitions) {
+        int spins = 0;
+        while (!partition->ready.load(std::memory_order_acquire)) {
+            backoff(spins);
+        }
+    }
+}
+
+template <typename Key, typename Value>
+PartitionedSkipList<Key, Value>::~PartitionedSkipList() {
+    stopping.store(true, std::memory_order_seq_cst);
+    for (std::unique_ptr<Partition>& partition : partitions) {
+        {
+            std::lock_guard<std::mutex> lock(partition->parkMutex);
+            partition->sleeping.store(false, std::memory_order_seq_cst);
+        }
+        partition->wake.notify_one();
+        partition->worker.join();
+    }
+}
+
+template <typename Key, typename Value>
+void PartitionedSkipList<Key, Value>::run(Partition& partition) {
+    // Pin before building the list so the header and every node are first
+    // touched, and therefore placed, on this partition's node
+    pinCurrentThread(partition.cpus);
+    SkipList<Key, Value> list(maxLevel);
+    partition.ready.store(true, std::memory_order_release);
+
+    int idle = 0;
+    for (;;) {
+        Request* request = partition.queue.pop();
+        if (request == nullptr) {
+            if (stopping.load(std::memory_order_acquire)) break;
+            // Spin, then yield, then park so an idle partition costs no CPU
+            if (++idle < kSpinsBeforeYield) continue;
+            if (idle < kSpinsBeforeYield + kYieldsBeforePark) {
+                std::this_thread::yield();
+                continue;
+            }
+            park(partition);
+            idle = 0;
+            continue;
+        }
+        idle = 0;
+
+        switch (request->op) {
+        case Op::Insert:
+            list.insert(request->key, request->value, request->ttl);
+            request->result = true;
+            break;
+        case Op::Search:
+            request->result = list.search(request->key, request->value);
+            break;
+        case Op::Erase:
+            request->result = list.erase(request->key);
+            break;
+        case Op::Cleanup:
+            list.cleanupExpiredNodes();
+            request->result = true;
+            break;
+        }
+        request->done.store(true, std::memory_order_release);
+    }
+}
+
+template <typename Key, typename Value>
+typename PartitionedSkipList<Key, Value>::Partition& PartitionedSkipList<Key, Value>::route(const Key& key) {
+    // Mix the hash so sequential integer keys spread across partitions
+    uint64_t h = mixHash(static_cast<uint64_t>(std::hash<Key>{}(key)));
+    return *partitions[(h >> 32) % partitions.size()];
+}
+
+template <typename Key, typename Value>
+void PartitionedSkipList<Key, Value>::park(Partition& partition) {
+    std::unique_lock<std::mutex> lock(partition.parkMutex);
+    partition.sleeping.store(true, std::memory_order_seq_cst);
+    // Pairs with the fence in enqueue(): either the producer sees sleeping
+    // set and notifies, or this check sees its request
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!partition.queue.empty() || stopping.load(std::memory_order_seq_cst)) {
+        partition.sleeping.store(false, std::memory_order_relaxed);
+        return;
+    }
+    partition.wake.wait(lock, [&partition] { return !partition.sleeping.load(std::memory_order_relaxed); });
+}
+
+template <typename Key, typename Value>
+void PartitionedSkipList<Key, Value>::enqueue(Partition& partition, Request* request) {
+    int spins = 0;
+    while (!partition.queue.push(request)) {
+        backoff(spins);
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (partition.sleeping.load(std::memory_order_seq_cst)) {
+        {
+            std::lock_guard<std::mutex> lock(partition.parkMutex);
+            partition.sleeping.store(false, std::memory_order_relaxed);
+        }
+        partition.wake.notify_one();
+    }
+}
+
+template <typename Key, typename Value>
+void PartitionedSkipList<Key, Value>::submit(Partition& partition, Request& request) {
+    enqueue(partition, &request);
+    int spins = 0;
+    while (!request.done.load(std::memory_order_acquire)) {
+        backoff(spins);
+    }
+}
+
+template <typename Key, typename Value>
+void PartitionedSkipList<Key, Value>::insert(Key key, Value value, std::chrono::steady_clock::time_point ttl) {
+    Request request;
+    request.op = Op::Insert;
+    request.key = key;
+    request.value = value;
+    request.ttl = ttl;
+    submit(route(key), request);
+}
+
+template <typename Key, typename Value>
+bool PartitionedSkipList<Key, Value>::search(Key key, Value& value) {
+    Request request;
+    request.op = Op::Search;
+    request.key = key;
+    submit(route(key), request);
+    if (request.result) {
+        value = request.value;
+    }
+    return request.result;
+}
+
+template <typename Key, typename Value>
+bool PartitionedSkipList<Key, Value>::erase(Key key) {
+    Request request;
+    request.op = Op::Erase;
+    request.key = key;
+    submit(route(key), request);
+    return request.result;
+}
+
+template <typename Key, typename Value>
+void PartitionedSkipList<Key, Value>::cleanupExpiredNodes() {
+    // Each partition expires its own nodes; requests are outstanding at the same time
+    std::vector<std::unique_ptr<Request>> requests;
+    for (std::unique_ptr<Partition>& partition : partitions) {
+        std::unique_ptr<Request> request(new Request);
+        request->op = Op::Cleanup;
+        enqueue(*partition, request.get());
+        requests.push_back(std::move(request));
+    }
+    for (std::unique_ptr<Request>& request : requests) {
+        int spins = 0;
+        while (!request->done.load(std::memory_order_acquire)) {
+            backoff(spins);
+        }
+    }
+}
+
+template <typename Key, typename Value>
+int PartitionedSkipList<Key, Value>::partitionCount() const {
+    return static_cast<int>(partitions.size());
+}
+
+template class PartitionedSkipList<int, std::string>;  // Explicit instantiation
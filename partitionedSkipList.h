@@ -0,0 +1,151 @@
+#ifndef PARTITIONED_SKIPLIST_H
+#define PARTITIONED_SKIPLIST_H
+
+#include "skipList.h"
+#include "hashUtil.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+// Bounded multi-producer/single-consumer queue of pointers (Vyukov-style ring).
+// Producers claim a slot with a CAS on enqueuePos; the owning partition thread
+// is the only consumer, so dequeuePos needs no synchronisation.
+template <typename T>
+class MPSCQueue {
+public:
+    explicit MPSCQueue(size_t capacity) {
+        size_t size = roundUpToPowerOfTwo(capacity < 2 ? 2 : capacity);
+        mask = size - 1;
+        buffer.reset(new Cell[size]);
+        for (size_t i = 0; i < size; ++i) {
+            buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueuePos.store(0, std::memory_order_relaxed);
+        dequeuePos = 0;
+    }
+
+    bool push(T* item) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = buffer[pos & mask];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = item;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Full
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Only meaningful on the consumer thread
+    bool empty() const {
+        const Cell& cell = buffer[dequeuePos & mask];
+        return (intptr_t)cell.sequence.load(std::memory_order_acquire) - (intptr_t)(dequeuePos + 1) < 0;
+    }
+
+    T* pop() {
+        Cell& cell = buffer[dequeuePos & mask];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if ((intptr_t)seq - (intptr_t)(dequeuePos + 1) < 0) {
+            return nullptr; // Empty
+        }
+        T* item = cell.data;
+        cell.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+        ++dequeuePos;
+        return item;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T* data;
+    };
+
+    std::unique_ptr<Cell[]> buffer;
+    size_t mask;
+    alignas(64) std::atomic<size_t> enqueuePos;
+    alignas(64) size_t dequeuePos;
+};
+
+// CPUs grouped by NUMA node, read from /sys/devices/system/node and limited
+// to the CPUs in the process's affinity mask. Nodes left without an allowed
+// CPU are dropped; machines without NUMA information are reported as a
+// single node holding every allowed CPU.
+std::vector<std::vector<int>> numaTopology();
+
+// Restricts the calling thread to the given CPUs. Returns false when pinning
+// is unsupported or refused, in which case the thread keeps running unpinned.
+bool pinCurrentThread(const std::vector<int>& cpus);
+
+enum class PartitionMode {
+    PerCore, // One partition per CPU, pinned to that CPU
+    PerNode  // One partition per NUMA node, pinned to the node's CPUs
+};
+
+// A cache split into independent SkipLists, each owned by one pinned thread.
+// Keys are routed to their partition by hash and every operation is shipped
+// to the owner through its MPSC queue, so a partition's header and nodes are
+// only ever allocated and touched from its own CPU(s). With the kernel's
+// default first-touch policy that keeps each partition in node-local memory.
+template <typename Key, typename Value>
+class PartitionedSkipList {
+public:
+    PartitionedSkipList(int maxLevel, PartitionMode mode = PartitionMode::PerCore, int partitions = 0);
+    ~PartitionedSkipList();
+
+    void insert(Key key, Value value, std::chrono::steady_clock::time_point ttl = std::chrono::steady_clock::time_point::max());
+    bool search(Key key, Value& value);
+    bool erase(Key key);
+    void cleanupExpiredNodes();
+    int partitionCount() const;
+
+private:
+    enum class Op { Insert, Search, Erase, Cleanup };
+
+    struct Request {
+        Op op;
+        Key key;
+        Value value;
+        std::chrono::steady_clock::time_point ttl;
+        bool result = false;
+        std::atomic<bool> done{false};
+    };
+
+    struct Partition {
+        explicit Partition(size_t queueCapacity) : queue(queueCapacity) {}
+
+        std::vector<int> cpus;
+        MPSCQueue<Request> queue;
+        std::thread worker;
+        std::atomic<bool> ready{false};
+
+        // Set by an idle owner before it parks on wake; producers notify only when set
+        std::atomic<bool> sleeping{false};
+        std::mutex parkMutex;
+        std::condition_variable wake;
+    };
+
+    void run(Partition& partition);
+    Partition& route(const Key& key);
+    void enqueue(Partition& partition, Request* request);
+    void submit(Partition& partition, Request& request);
+    void park(Partition& partition);
+
+    const int maxLevel;
+    std::vector<std::unique_ptr<Partition>> partitions;
+    std::atomic<bool> stopping{false};
+};
+
+#endif // PARTITIONED_SKIPLIST_H
@@ -12,7 +12,7 @@ SkipList<Key, Value>::~SkipList() {
     while (current != nullptr) {
         Node* temp = current;
         current = current->forward[0];
-        delete temp;
+        destroyNode(temp);
     }
 }
 
@@ -50,13 +50,39 @@ void SkipList<Key, Value>::insert(Key key, Value value, std::chrono::steady_cloc
             newNode->forward[i] = update[i]->forward[i];
             update[i]->forward[i] = newNode;
         }
+
+        if (missFilter) {
+            missFilter->add(key);
+        }
+        compaction.stale = true;
     } else {
         current->value = value;
+        if (hotKeyCache) {
+            hotKeyCache->update(key, value);
+        }
     }
 }
 
 template <typename Key, typename Value>
 bool SkipList<Key, Value>::search(Key key, Value& value) {
+    bool hot = false;
+    if (hotKeyTracker) {
+        Key evicted{};
+        bool didEvict = false;
+        hot = hotKeyTracker->record(key, evicted, didEvict);
+        if (didEvict) {
+            hotKeyCache->erase(evicted);
+        }
+        // Only top-K keys are ever cached, so colder keys skip the probe
+        if (hot && hotKeyCache->get(key, value)) {
+            return true;
+        }
+    }
+
+    if (missFilter && !missFilter->mayContain(key)) {
+        return false;
+    }
+
     Node* current = header;
 
     for (int i = currentLevel - 1; i >= 0; --i) {
@@ -69,6 +95,9 @@ bool SkipList<Key, Value>::search(Key key, Value& value) {
 
     if (current != nullptr && current->key == key) {
         value = current->value;
+        if (hot) {
+            hotKeyCache->put(key, current->value);
+        }
         return true;
     }
     return false;
@@ -94,7 +123,15 @@ bool SkipList<Key, Value>::erase(Key key) {
             update[i]->forward[i] = current->forward[i];
         }
 
-        delete current;
+        if (missFilter) {
+            missFilter->remove(key);
+        }
+        if (hotKeyCache) {
+            hotKeyCache->erase(key);
+        }
+
+        destroyNode(current);
+        compaction.stale = true;
         while (currentLevel > 0 && header->forward[currentLevel - 1] == nullptr) {
             --currentLevel;
         }
@@ -306,10 +343,227 @@ void SkipList<Key, Value>::cleanupExpiredNodes() {
     }
 }
 
+template <typename Key, typename Value>
+void SkipList<Key, Value>::enableMissFilter(size_t expectedKeys, double falsePositiveRate) {
+    missFilterExpectedKeys = expectedKeys;
+    missFilterFalsePositiveRate = falsePositiveRate;
+    buildMissFilter();
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::disableMissFilter() {
+    missFilter.reset();
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::rebuildMissFilter() {
+    if (!missFilter) return;
+    buildMissFilter();
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::buildMissFilter() {
+    // Count live keys first so a list that outgrew its sizing gets a larger filter
+    size_t liveKeys = 0;
+    for (Node* node = header->forward[0]; node != nullptr; node = node->forward[0]) {
+        ++liveKeys;
+    }
+
+    // Rebuilding also clears counters that saturated and could never drop back to zero
+    missFilter.reset(new CountingBloomFilter<Key>(std::max(missFilterExpectedKeys, liveKeys), missFilterFalsePositiveRate));
+    for (Node* node = header->forward[0]; node != nullptr; node = node->forward[0]) {
+        missFilter->add(node->key);
+    }
+}
+
+template <typename Key, typename Value>
+size_t SkipList<Key, Value>::missFilterMemoryUsage() const {
+    return missFilter ? missFilter->memoryUsage() : 0;
+}
+
+template <typename Key, typename Value>
+bool SkipList<Key, Value>::missFilterMayContain(Key key) const {
+    return !missFilter || missFilter->mayContain(key);
+}
+
+template <typename Key, typename Value>
+bool SkipList<Key, Value>::beginCompaction(bool relevel) {
+    if (compaction.active) return false;
+
+    compaction.active = true;
+    compaction.relevel = relevel;
+    compaction.started = false;
+    compaction.ordinal = 0;
+    compaction.update.assign(maxLevel, header);
+    compaction.stale = false;
+    return true;
+}
+
+template <typename Key, typename Value>
+bool SkipList<Key, Value>::compactStep(size_t maxNodes) {
+    if (!compaction.active) return false;
+
+    std::vector<Node*>& update = compaction.update;
+    if (compaction.stale) {
+        // An insert or erase may have freed or bypassed a saved predecessor,
+        // so find them again from the last relocated key
+        Node* current = header;
+        for (int i = maxLevel - 1; i >= 0; --i) {
+            while (compaction.started && current->forward[i] != nullptr && current->forward[i]->key <= compaction.lastKey) {
+                current = current->forward[i];
+            }
+            update[i] = current;
+        }
+        compaction.stale = false;
+    }
+
+    for (size_t n = 0; n < maxNodes; ++n) {
+        Node* old = update[0]->forward[0];
+        if (old == nullptr) {
+            finishCompaction();
+            return false;
+        }
+
+        int oldLevel = static_cast<int>(old->forward.size());
+        int newLevel = compaction.relevel ? idealLevel(++compaction.ordinal) : oldLevel;
+        Node* fresh = createCompactedNode(old, newLevel);
+
+        for (int i = 0; i < std::max(oldLevel, newLevel); ++i) {
+            Node* next = update[i]->forward[i] == old ? old->forward[i] : update[i]->forward[i];
+            if (i < newLevel) {
+                fresh->forward[i] = next;
+                update[i]->forward[i] = fresh;
+                update[i] = fresh;
+            } else {
+                update[i]->forward[i] = next;
+            }
+        }
+        currentLevel = std::max(currentLevel, newLevel);
+
+        destroyNode(old);
+        compaction.lastKey = fresh->key;
+        compaction.started = true;
+    }
+    return true;
+}
+
+template <typename Key, typename Value>
+typename SkipList<Key, Value>::Node* SkipList<Key, Value>::createCompactedNode(Node* old, int level) {
+    const size_t slabBytes = 256 * 1024;
+    const size_t align = alignof(std::max_align_t);
+    size_t bytes = sizeof(Node) + level * sizeof(Node*) + 2 * align;
+
+    NodeSlab* slab = compaction.slab;
+    if (slab == nullptr || slab->capacity - slab->used < bytes) {
+        slabs.emplace_back(new NodeSlab(slabBytes));
+        compaction.slab = slabs.back().get();
+        if (slab != nullptr && slab->liveNodes == 0) {
+            releaseSlab(slab);
+        }
+        slab = compaction.slab;
+    }
+
+    // The node and its forward array are carved from the slab back to back
+    Node* node = new (slab->allocate(sizeof(Node))) Node(std::move(old->key), std::move(old->value), level, old->ttl, slab);
+    ++slab->liveNodes;
+    return node;
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::destroyNode(Node* node) {
+    NodeSlab* slab = node->forward.get_allocator().slab;
+    if (slab == nullptr) {
+        delete node;
+        return;
+    }
+
+    node->~Node();
+    if (--slab->liveNodes == 0 && slab != compaction.slab) {
+        releaseSlab(slab);
+    }
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::releaseSlab(NodeSlab* slab) {
+    for (size_t i = 0; i < slabs.size(); ++i) {
+        if (slabs[i].get() == slab) {
+            slabs[i] = std::move(slabs.back());
+            slabs.pop_back();
+            return;
+        }
+    }
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::finishCompaction() {
+    NodeSlab* slab = compaction.slab;
+    compaction.slab = nullptr;
+    if (slab != nullptr && slab->liveNodes == 0) {
+        releaseSlab(slab);
+    }
+
+    while (currentLevel > 0 && header->forward[currentLevel - 1] == nullptr) {
+        --currentLevel;
+    }
+    compaction.update.clear();
+    compaction.active = false;
+}
+
+template <typename Key, typename Value>
+bool SkipList<Key, Value>::compactionInProgress() const {
+    return compaction.active;
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::compact(bool relevel) {
+    // A pass already running in the requested mode (or re-levelling anyway) only needs finishing
+    bool satisfied = compaction.active && (compaction.relevel || !relevel);
+    while (compactStep(1024)) {
+    }
+    if (satisfied) return;
+
+    beginCompaction(relevel);
+    while (compactStep(1024)) {
+    }
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::enableHotKeyCache(size_t topK) {
+    hotKeyTracker.reset(new HotKeyTracker<Key>(topK));
+    hotKeyCache.reset(new HotKeyCache<Key, Value>(topK));
+}
+
+template <typename Key, typename Value>
+void SkipList<Key, Value>::disableHotKeyCache() {
+    hotKeyTracker.reset();
+    hotKeyCache.reset();
+}
+
+template <typename Key, typename Value>
+std::vector<std::pair<Key, uint32_t>> SkipList<Key, Value>::hotKeys() const {
+    if (!hotKeyTracker) {
+        return {};
+    }
+    return hotKeyTracker->topK();
+}
+
+template <typename Key, typename Value>
+int SkipList<Key, Value>::idealLevel(size_t ordinal) const {
+    // The n-th node gets one level plus the number of trailing zero bits of n,
+    // giving exactly the p = 1/2 spacing randomLevel() aims for
+    int level = 1;
+    while ((ordinal & 1) == 0 && level < maxLevel) {
+        ordinal >>= 1;
+        ++level;
+    }
+    return level;
+}
+
 template <typename Key, typename Value>
 int SkipList<Key, Value>::randomLevel() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    // Per-thread generator: partitioned caches run one SkipList per thread
+    static thread_local std::random_device rd;
+    static thread_local std::mt19937 gen(rd());
     std::uniform_int_distribution<> dis(0, 1);
 
     int level = 1;
@@ -8,6 +8,9 @@
 #include <random>
 #include <memory>
 #include <iomanip> // For std::setw
+#include "countingBloomFilter.h"
+#include "nodeSlab.h"
+#include "hotKeys.h"
 
 template <typename Key, typename Value>
 class SkipList {
@@ -15,11 +18,11 @@ public:
     struct Node {
         Key key;
         Value value;
-        std::vector<Node*> forward;
+        std::vector<Node*, SlabAllocator<Node*>> forward;  // Allocator's slab is set for nodes relocated by compaction
         std::chrono::steady_clock::time_point ttl;
 
-        Node(Key k, Value v, int level, std::chrono::steady_clock::time_point ttl = std::chrono::steady_clock::time_point::max())
-            : key(k), value(v), forward(level, nullptr), ttl(ttl) {}
+        Node(Key k, Value v, int level, std::chrono::steady_clock::time_point ttl = std::chrono::steady_clock::time_point::max(), NodeSlab* slab = nullptr)
+            : key(std::move(k)), value(std::move(v)), forward(level, nullptr, SlabAllocator<Node*>(slab)), ttl(ttl) {}
     };
 
     SkipList(int maxLevel);
@@ -32,13 +35,63 @@ public:
     void removeExpiredNodes();
     void cleanupExpiredNodes();
 
+    // Optional negative-lookup filter: definite misses return without descending
+    void enableMissFilter(size_t expectedKeys, double falsePositiveRate = 0.01);
+    void disableMissFilter();
+    void rebuildMissFilter();  // No-op unless a filter is enabled
+    size_t missFilterMemoryUsage() const;
+    bool missFilterMayContain(Key key) const;  // True when no filter is enabled
+
+    // Incremental compaction: each step copies up to maxNodes nodes, in key
+    // order, into fresh slab memory and splices them in place of the
+    // originals, optionally re-levelling towers to ideal spacing. Lookups and
+    // updates may run between steps; compactStep() returns false once done.
+    // beginCompaction() returns false, leaving the running pass and its mode
+    // unchanged, if a pass is already in progress. compact() finishes any
+    // running pass, then runs a full one if that pass did not re-level and
+    // relevel was requested.
+    bool beginCompaction(bool relevel = false);
+    bool compactStep(size_t maxNodes);
+    bool compactionInProgress() const;
+    void compact(bool relevel = false);
+
+    // Optional front-side cache for skewed workloads: search() tracks key
+    // frequencies and serves the current top-K keys without descending
+    void enableHotKeyCache(size_t topK = 32);
+    void disableHotKeyCache();
+    std::vector<std::pair<Key, uint32_t>> hotKeys() const;
+
 private:
+    struct Compaction {
+        bool active = false;
+        bool relevel = false;
+        bool stale = false;          // Structure changed since the last step
+        bool started = false;        // lastKey is valid
+        Key lastKey{};
+        size_t ordinal = 0;          // Nodes relocated so far, drives re-levelling
+        std::vector<Node*> update;   // Last node at each level before the cursor
+        NodeSlab* slab = nullptr;    // Slab currently being filled
+    };
+
     Node* createNode(Key key, Value value, int level, std::chrono::steady_clock::time_point ttl);
     int randomLevel();
+    int idealLevel(size_t ordinal) const;
+    void buildMissFilter();
+    Node* createCompactedNode(Node* old, int level);
+    void destroyNode(Node* node);
+    void releaseSlab(NodeSlab* slab);
+    void finishCompaction();
 
     const int maxLevel;
     Node* header;
     int currentLevel;
+    std::unique_ptr<CountingBloomFilter<Key>> missFilter;
+    size_t missFilterExpectedKeys = 0;
+    double missFilterFalsePositiveRate = 0.01;
+    Compaction compaction;
+    std::vector<std::unique_ptr<NodeSlab>> slabs;
+    std::unique_ptr<HotKeyTracker<Key>> hotKeyTracker;
+    std::unique_ptr<HotKeyCache<Key, Value>> hotKeyCache;
 };
 
 #endif // SKIPLIST_H
@@ -0,0 +1,108 @@
+#include "skipList.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <set>
+#include <algorithm>
+
+// Churns a SkipList until its nodes are scattered across the heap, then
+// measures level-0 scans and lookups before and after compaction.
+
+const int keyCount = 500000;
+const int churnRounds = 2000000;
+const int lookupCount = 1000000;
+const int keyRange = 4 * keyCount;
+
+double scanMillis(SkipList<int, std::string>& skipList) {
+    // No node carries a TTL, so this is a pure level-0 walk
+    auto start = std::chrono::steady_clock::now();
+    skipList.cleanupExpiredNodes();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+double lookupNanos(SkipList<int, std::string>& skipList, const std::vector<int>& keys) {
+    std::string value;
+    int found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int key : keys) {
+        found += skipList.search(key, value);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    if (found != static_cast<int>(keys.size())) {
+        std::cout << "ERROR: " << keys.size() - found << " keys missing" << std::endl;
+    }
+    return std::chrono::duration<double, std::nano>(elapsed).count() / keys.size();
+}
+
+void report(const std::string& label, SkipList<int, std::string>& skipList, const std::vector<int>& keys) {
+    std::cout << std::left << std::setw(28) << label << std::fixed << std::setprecision(1)
+              << std::setw(16) << scanMillis(skipList)
+              << std::setw(16) << lookupNanos(skipList, keys) << std::endl;
+}
+
+int main() {
+    SkipList<int, std::string> skipList(20);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> keyDist(1, keyRange);
+
+    std::cout << "Inserting " << keyCount << " keys and churning " << churnRounds << " times..." << std::endl;
+    std::set<int> live;
+    while (static_cast<int>(live.size()) < keyCount) {
+        int key = keyDist(gen);
+        if (live.insert(key).second) {
+            skipList.insert(key, "value_" + std::to_string(key));
+        }
+    }
+    std::vector<int> liveKeys(live.begin(), live.end());
+    for (int round = 0; round < churnRounds; ++round) {
+        // Replace a random live key so freed nodes get reused at random places
+        size_t victim = std::uniform_int_distribution<size_t>(0, liveKeys.size() - 1)(gen);
+        int key;
+        do {
+            key = keyDist(gen);
+        } while (live.count(key));
+        skipList.erase(liveKeys[victim]);
+        live.erase(liveKeys[victim]);
+        skipList.insert(key, "value_" + std::to_string(key));
+        live.insert(key);
+        liveKeys[victim] = key;
+    }
+
+    std::vector<int> lookups;
+    for (int i = 0; i < lookupCount; ++i) {
+        lookups.push_back(liveKeys[std::uniform_int_distribution<size_t>(0, liveKeys.size() - 1)(gen)]);
+    }
+
+    std::cout << std::left << std::setw(28) << "" << std::setw(16) << "scan ms" << std::setw(16) << "lookup ns" << std::endl;
+    report("churned", skipList, lookups);
+
+    // Incremental pass with writes interleaved between steps; record every step's duration
+    skipList.beginCompaction(false);
+    std::vector<double> stepMicros;
+    int steps = 0;
+    for (bool more = true; more; ++steps) {
+        auto start = std::chrono::steady_clock::now();
+        more = skipList.compactStep(256);
+        stepMicros.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+
+        if (steps % 64 == 0) {
+            size_t victim = std::uniform_int_distribution<size_t>(0, liveKeys.size() - 1)(gen);
+            skipList.erase(liveKeys[victim]);
+            live.erase(liveKeys[victim]);
+            skipList.insert(liveKeys[victim], "value_" + std::to_string(liveKeys[victim]));
+            live.insert(liveKeys[victim]);
+        }
+    }
+    report("compacted", skipList, lookups);
+    std::sort(stepMicros.begin(), stepMicros.end());
+    std::cout << "  " << steps << " steps of 256 nodes: p50 " << std::setprecision(1) << stepMicros[stepMicros.size() / 2]
+              << " us, p99 " << stepMicros[stepMicros.size() * 99 / 100]
+              << " us, max " << stepMicros.back() << " us" << std::endl;
+
+    skipList.compact(true);
+    report("compacted + re-levelled", skipList, lookups);
+
+    return 0;
+}
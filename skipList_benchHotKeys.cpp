@@ -0,0 +1,92 @@
+#include "skipList.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Replays Zipf-distributed lookup traces against a SkipList with and without
+// the hot-key front cache and reports per-lookup p50/p99 latency.
+
+const int keyCount = 1000000;
+const int traceLength = 2000000;
+
+std::vector<int> zipfTrace(double skew, const std::vector<int>& keys, std::mt19937& gen) {
+    // Cumulative weights of rank r proportional to 1 / r^skew
+    std::vector<double> cdf(keys.size());
+    double sum = 0;
+    for (size_t r = 0; r < keys.size(); ++r) {
+        sum += 1.0 / std::pow(static_cast<double>(r + 1), skew);
+        cdf[r] = sum;
+    }
+
+    std::uniform_real_distribution<> dist(0.0, sum);
+    std::vector<int> trace;
+    trace.reserve(traceLength);
+    for (int i = 0; i < traceLength; ++i) {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), dist(gen)) - cdf.begin();
+        trace.push_back(keys[std::min(rank, keys.size() - 1)]);
+    }
+    return trace;
+}
+
+void measure(SkipList<int, std::string>& skipList, const std::vector<int>& trace, double& p50, double& p99) {
+    std::vector<double> latencies;
+    latencies.reserve(trace.size());
+    std::string value;
+    for (int key : trace) {
+        auto start = std::chrono::steady_clock::now();
+        skipList.search(key, value);
+        latencies.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    p50 = latencies[latencies.size() / 2];
+    p99 = latencies[latencies.size() * 99 / 100];
+}
+
+int main() {
+    SkipList<int, std::string> skipList(20);
+    std::mt19937 gen(42);
+
+    std::cout << "Inserting " << keyCount << " keys..." << std::endl;
+    std::vector<int> keys;
+    for (int i = 0; i < keyCount; ++i) {
+        keys.push_back(i);
+        skipList.insert(i, "value_" + std::to_string(i));
+    }
+    // Scatter popularity ranks across the key space
+    std::shuffle(keys.begin(), keys.end(), gen);
+
+    std::cout << std::left << std::setw(8) << "zipf"
+              << std::setw(14) << "plain p50"
+              << std::setw(14) << "plain p99"
+              << std::setw(14) << "cached p50"
+              << std::setw(14) << "cached p99" << std::endl;
+
+    const double skews[] = { 0.9, 1.0, 1.1, 1.2 };
+    for (double skew : skews) {
+        std::vector<int> trace = zipfTrace(skew, keys, gen);
+
+        double plainP50, plainP99, cachedP50, cachedP99;
+        skipList.disableHotKeyCache();
+        measure(skipList, trace, plainP50, plainP99);
+
+        skipList.enableHotKeyCache(64);
+        measure(skipList, trace, cachedP50, cachedP99);
+
+        std::cout << std::left << std::setw(8) << std::setprecision(1) << std::fixed << skew
+                  << std::setw(14) << plainP50 << std::setw(14) << plainP99
+                  << std::setw(14) << cachedP50 << std::setw(14) << cachedP99 << std::endl;
+
+        std::vector<std::pair<int, uint32_t>> hot = skipList.hotKeys();
+        std::cout << "        top keys:";
+        for (size_t i = 0; i < std::min<size_t>(5, hot.size()); ++i) {
+            std::cout << " " << hot[i].first << " (" << hot[i].second << ")";
+        }
+        std::cout << "  hottest by rank: " << keys[0] << " " << keys[1] << " " << keys[2] << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include "skipList.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+
+// Measures the cost of a miss in SkipList::search with and without the
+// negative-lookup filter, at several false-positive targets.
+
+const int keyCount = 1000000;
+const int missCount = 1000000;
+
+double averageMissNanos(SkipList<int, std::string>& skipList, const std::vector<int>& misses) {
+    std::string value;
+    auto start = std::chrono::steady_clock::now();
+    for (int key : misses) {
+        skipList.search(key, value);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / misses.size();
+}
+
+int main() {
+    SkipList<int, std::string> skipList(20);
+
+    // Even keys are present, odd keys are guaranteed misses
+    std::cout << "Inserting " << keyCount << " keys..." << std::endl;
+    for (int i = 0; i < keyCount; ++i) {
+        skipList.insert(2 * i, "value_" + std::to_string(i));
+    }
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> keyDist(0, keyCount - 1);
+    std::vector<int> misses;
+    for (int i = 0; i < missCount; ++i) {
+        misses.push_back(2 * keyDist(gen) + 1);
+    }
+
+    double baseline = averageMissNanos(skipList, misses);
+
+    std::cout << std::left << std::setw(12) << "target fpr"
+              << std::setw(14) << "miss ns/op"
+              << std::setw(14) << "probe ns/op"
+              << std::setw(14) << "speedup"
+              << std::setw(14) << "filter KiB"
+              << std::setw(14) << "bytes/key"
+              << std::setw(14) << "measured fpr" << std::endl;
+    std::cout << std::left << std::setw(12) << "none" << std::fixed << std::setprecision(1)
+              << std::setw(14) << baseline << std::setw(14) << "-" << std::setw(14) << 1.0
+              << std::setw(14) << 0.0 << std::setw(14) << 0.0 << std::setw(14) << "-" << std::endl;
+
+    const double rates[] = { 0.1, 0.05, 0.01, 0.001, 0.0001 };
+    for (double rate : rates) {
+        skipList.enableMissFilter(keyCount, rate);
+
+        // Every key in misses is absent, so each filter pass is a false positive
+        int passes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int key : misses) {
+            if (skipList.missFilterMayContain(key)) ++passes;
+        }
+        double probe = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / misses.size();
+
+        double filtered = averageMissNanos(skipList, misses);
+        size_t bytes = skipList.missFilterMemoryUsage();
+        std::cout << std::left << std::setw(12) << std::defaultfloat << rate << std::fixed << std::setprecision(1)
+                  << std::setw(14) << filtered
+                  << std::setw(14) << probe
+                  << std::setw(14) << baseline / filtered
+                  << std::setw(14) << bytes / 1024.0
+                  << std::setw(14) << static_cast<double>(bytes) / keyCount
+                  << std::setw(14) << std::setprecision(5) << static_cast<double>(passes) / misses.size() << std::endl;
+    }
+
+    // Erase half the keys (as TTL cleanup would) and check the filter still admits the survivors
+    for (int i = 0; i < keyCount; i += 2) {
+        skipList.erase(2 * i);
+    }
+    std::string value;
+    int lost = 0;
+    for (int i = 1; i < keyCount; i += 2) {
+        if (!skipList.search(2 * i, value)) ++lost;
+    }
+    std::cout << "\nAfter erasing half the keys: " << lost << " surviving keys rejected by the filter" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include "skipList.h"
+#include "partitionedSkipList.h"
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <random>
+#include <vector>
+
+// Compares one mutex-guarded SkipList shared by every thread against the
+// partitioned cache, as the number of client threads grows.
+
+const int keyRange = 1000000;
+const int preloadCount = 200000;
+const int opsPerThread = 200000;
+const int searchPercent = 80;
+
+template <typename Cache, typename Insert, typename Search>
+double runClients(int threads, Cache& cache, Insert insert, Search search) {
+    std::vector<std::thread> clients;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        clients.emplace_back([&, t] {
+            std::mt19937 gen(t + 1);
+            std::uniform_int_distribution<> keyDist(1, keyRange);
+            std::uniform_int_distribution<> opDist(0, 99);
+            std::string value;
+            for (int i = 0; i < opsPerThread; ++i) {
+                int key = keyDist(gen);
+                if (opDist(gen) < searchPercent) {
+                    search(cache, key, value);
+                } else {
+                    insert(cache, key, "value_" + std::to_string(key));
+                }
+            }
+        });
+    }
+    for (std::thread& client : clients) {
+        client.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return threads * opsPerThread / seconds / 1e6;
+}
+
+int main() {
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::vector<int>> nodes = numaTopology();
+    std::cout << "Detected " << nodes.size() << " NUMA node(s), " << cores << " CPU(s)" << std::endl;
+
+    std::vector<int> threadCounts;
+    for (unsigned t = 1; t <= 2 * cores; t *= 2) {
+        threadCounts.push_back(t);
+    }
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> keyDist(1, keyRange);
+    std::vector<int> preload;
+    for (int i = 0; i < preloadCount; ++i) {
+        preload.push_back(keyDist(gen));
+    }
+
+    std::cout << std::left << std::setw(10) << "threads"
+              << std::setw(16) << "shared Mops/s"
+              << std::setw(18) << "per-core Mops/s"
+              << std::setw(18) << "per-node Mops/s" << std::endl;
+
+    for (int threads : threadCounts) {
+        SkipList<int, std::string> shared(16);
+        std::mutex sharedMutex;
+        for (int key : preload) {
+            shared.insert(key, "value_" + std::to_string(key));
+        }
+        double sharedRate = runClients(threads, shared,
+            [&](SkipList<int, std::string>& list, int key, const std::string& value) {
+                std::lock_guard<std::mutex> lock(sharedMutex);
+                list.insert(key, value);
+            },
+            [&](SkipList<int, std::string>& list, int key, std::string& value) {
+                std::lock_guard<std::mutex> lock(sharedMutex);
+                list.search(key, value);
+            });
+
+        double partitionedRates[2];
+        PartitionMode modes[2] = { PartitionMode::PerCore, PartitionMode::PerNode };
+        for (int m = 0; m < 2; ++m) {
+            PartitionedSkipList<int, std::string> partitioned(16, modes[m]);
+            for (int key : preload) {
+                partitioned.insert(key, "value_" + std::to_string(key));
+            }
+            partitionedRates[m] = runClients(threads, partitioned,
+                [](PartitionedSkipList<int, std::string>& cache, int key, const std::string& value) {
+                    cache.insert(key, value);
+                },
+                [](PartitionedSkipList<int, std::string>& cache, int key, std::string& value) {
+                    cache.search(key, value);
+                });
+        }
+
+        std::cout << std::left << std::setw(10) << threads << std::fixed << std::setprecision(3)
+                  << std::setw(16) << sharedRate
+                  << std::setw(18) << partitionedRates[0]
+                  << std::setw(18) << partitionedRates[1] << std::endl;
+    }
+
+    return 0;
+}
@@ -1,10 +1,283 @@
 #include "skipList.h"
+#include "partitionedSkipList.h"
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <random>
+#include <map>
+#include <atomic>
+#include <vector>
+#include <set>
+
+// Concurrent clients on disjoint key ranges, checked against per-thread
+// reference maps. An explicit partition count exercises routing even on a
+// single-CPU machine.
+bool testPartitionedSkipList() {
+    const int threads = 4;
+    const int keysPerThread = 2000;
+    const int opsPerThread = 50000;
+    PartitionedSkipList<int, std::string> cache(16, PartitionMode::PerCore, 4);
+    std::atomic<int> errors(0);
+
+    std::vector<std::thread> clients;
+    for (int t = 0; t < threads; ++t) {
+        clients.emplace_back([&, t] {
+            std::mt19937 gen(t + 1);
+            std::uniform_int_distribution<> keyDist(t * keysPerThread, (t + 1) * keysPerThread - 1);
+            std::uniform_int_distribution<> opDist(0, 99);
+            std::map<int, std::string> reference;
+            std::string value;
+            for (int i = 0; i < opsPerThread; ++i) {
+                int key = keyDist(gen);
+                int op = opDist(gen);
+                if (op < 40) {
+                    std::string v = "value_" + std::to_string(i);
+                    cache.insert(key, v);
+                    reference[key] = v;
+                } else if (op < 60) {
+                    if (cache.erase(key) != (reference.erase(key) == 1)) ++errors;
+                } else if (op < 99) {
+                    auto it = reference.find(key);
+                    bool found = cache.search(key, value);
+                    if (found != (it != reference.end()) || (found && value != it->second)) ++errors;
+                } else {
+                    // No entry carries a TTL, so concurrent cleanups must not remove anything
+                    cache.cleanupExpiredNodes();
+                }
+            }
+            for (const auto& entry : reference) {
+                if (!cache.search(entry.first, value) || value != entry.second) ++errors;
+            }
+        });
+    }
+    for (std::thread& client : clients) {
+        client.join();
+    }
+
+    // Expired entries spread over every partition are removed by one cleanup call
+    int base = threads * keysPerThread;
+    auto past = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+    for (int key = base; key < base + 100; ++key) {
+        cache.insert(key, "expired", past);
+    }
+    cache.cleanupExpiredNodes();
+    std::string value;
+    for (int key = base; key < base + 100; ++key) {
+        if (cache.search(key, value)) ++errors;
+    }
+
+    std::cout << "Partitioned cache (" << cache.partitionCount() << " partitions): "
+              << (errors == 0 ? "passed" : std::to_string(errors) + " mismatches") << std::endl;
+    return errors == 0;
+}
+
+// Inserts, erases, re-inserts, TTL cleanups and rebuilds on a filter sized
+// far below the live key count, so counters saturate, checked against a
+// reference map. Rebuilding a disabled filter must leave it disabled.
+bool testMissFilter() {
+    const int keyRange = 2000;
+    int errors = 0;
+    SkipList<int, std::string> skipList(16);
+
+    skipList.rebuildMissFilter();
+    if (skipList.missFilterMemoryUsage() != 0) ++errors;
+    skipList.enableMissFilter(16, 0.01);
+    if (skipList.missFilterMemoryUsage() == 0) ++errors;
+    skipList.disableMissFilter();
+    skipList.rebuildMissFilter();
+    if (skipList.missFilterMemoryUsage() != 0) ++errors;
+    skipList.enableMissFilter(16, 0.01);
+
+    std::map<int, std::string> reference;
+    std::set<int> expiring;  // Live keys whose TTL is already in the past
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<> keyDist(0, keyRange - 1);
+    auto past = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+    std::string value;
+
+    for (int i = 0; i < 40000; ++i) {
+        int key = keyDist(gen);
+        switch (gen() % 8) {
+        case 0:
+        case 1:
+            skipList.insert(key, "value_" + std::to_string(i));
+            reference[key] = "value_" + std::to_string(i);
+            break;
+        case 2:
+            // Only new keys get a TTL; insert on an existing key keeps its TTL
+            if (!reference.count(key)) {
+                skipList.insert(key, "expiring", past);
+                reference[key] = "expiring";
+                expiring.insert(key);
+            }
+            break;
+        case 3:
+        case 4:
+            if (skipList.erase(key) != (reference.erase(key) == 1)) ++errors;
+            expiring.erase(key);
+            break;
+        default: {
+            auto it = reference.find(key);
+            bool found = skipList.search(key, value);
+            if (found != (it != reference.end()) || (found && value != it->second)) ++errors;
+        }
+        }
+
+        if (i % 5000 == 4999) {
+            skipList.cleanupExpiredNodes();
+            for (int expired : expiring) {
+                reference.erase(expired);
+            }
+            expiring.clear();
+        }
+        if (i % 7000 == 6999) {
+            skipList.rebuildMissFilter();
+        }
+    }
+
+    for (int key = -100; key < keyRange + 100; ++key) {
+        auto it = reference.find(key);
+        bool found = skipList.search(key, value);
+        if (found != (it != reference.end()) || (found && value != it->second)) ++errors;
+    }
+
+    std::cout << "Miss filter: " << (errors == 0 ? "passed" : std::to_string(errors) + " mismatches") << std::endl;
+    return errors == 0;
+}
+
+// Compaction steps interleaved with inserts, erases and searches must leave
+// the list answering exactly like a reference map, with and without
+// re-levelling, across several passes.
+bool testCompaction() {
+    const int keyRange = 5000;
+    int errors = 0;
+    for (int relevel = 0; relevel < 2; ++relevel) {
+        SkipList<int, std::string> skipList(16);
+        std::map<int, std::string> reference;
+        std::mt19937 gen(relevel + 1);
+        std::uniform_int_distribution<> keyDist(0, keyRange - 1);
+        std::string value;
+
+        for (int i = 0; i < 2000; ++i) {
+            int key = keyDist(gen);
+            skipList.insert(key, "value_" + std::to_string(key));
+            reference[key] = "value_" + std::to_string(key);
+        }
+
+        for (int pass = 0; pass < 3; ++pass) {
+            skipList.beginCompaction(relevel == 1);
+            while (skipList.compactStep(37)) {
+                for (int op = 0; op < 5; ++op) {
+                    int key = keyDist(gen);
+                    switch (gen() % 3) {
+                    case 0:
+                        if (skipList.erase(key) != (reference.erase(key) == 1)) ++errors;
+                        break;
+                    case 1:
+                        skipList.insert(key, "pass" + std::to_string(pass) + "_" + std::to_string(key));
+                        reference[key] = "pass" + std::to_string(pass) + "_" + std::to_string(key);
+                        break;
+                    default: {
+                        auto it = reference.find(key);
+                        bool found = skipList.search(key, value);
+                        if (found != (it != reference.end()) || (found && value != it->second)) ++errors;
+                    }
+                    }
+                }
+            }
+
+            for (int key = 0; key < keyRange; ++key) {
+                auto it = reference.find(key);
+                bool found = skipList.search(key, value);
+                if (found != (it != reference.end()) || (found && value != it->second)) ++errors;
+            }
+        }
+
+        // A second begin is refused while a pass runs; compact() still finishes cleanly
+        if (!skipList.beginCompaction(relevel == 1)) ++errors;
+        skipList.compactStep(100);
+        if (skipList.beginCompaction(true)) ++errors;
+        skipList.compact(true);
+        if (skipList.compactionInProgress()) ++errors;
+        for (int key = 0; key < keyRange; ++key) {
+            auto it = reference.find(key);
+            bool found = skipList.search(key, value);
+            if (found != (it != reference.end()) || (found && value != it->second)) ++errors;
+        }
+
+        // Destroying the list in the middle of a pass must not leak or double free
+        skipList.beginCompaction(relevel == 1);
+        skipList.compactStep(100);
+    }
+
+    std::cout << "Compaction: " << (errors == 0 ? "passed" : std::to_string(errors) + " mismatches") << std::endl;
+    return errors == 0;
+}
+
+// A hot key must stay coherent with the list through an update, an erase and
+// a TTL expiry, and hotKeys() must list the most accessed keys first.
+bool testHotKeyCache() {
+    const int hotKey = 7;
+    int errors = 0;
+    SkipList<int, std::string> skipList(16);
+    skipList.enableHotKeyCache(4);
+    for (int key = 0; key < 100; ++key) {
+        skipList.insert(key, "value_" + std::to_string(key));
+    }
+
+    auto expect = [&](bool present, const std::string& expected) {
+        std::string value;
+        bool found = skipList.search(hotKey, value);
+        if (found != present || (found && value != expected)) ++errors;
+    };
+    auto makeHot = [&](const std::string& expected) {
+        for (int i = 0; i < 50; ++i) {
+            expect(true, expected);
+        }
+        std::vector<std::pair<int, uint32_t>> hot = skipList.hotKeys();
+        if (hot.empty() || hot.front().first != hotKey) ++errors;
+    };
+
+    makeHot("value_7");
+    skipList.insert(hotKey, "updated");
+    expect(true, "updated");
+
+    skipList.erase(hotKey);
+    expect(false, "");
+
+    skipList.insert(hotKey, "short-lived", std::chrono::steady_clock::now() + std::chrono::milliseconds(50));
+    makeHot("short-lived");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    skipList.cleanupExpiredNodes();
+    expect(false, "");
+
+    // Skewed accesses: key k is searched 40 - 10k times
+    SkipList<int, std::string> skewed(16);
+    skewed.enableHotKeyCache(4);
+    std::string value;
+    for (int key = 0; key < 4; ++key) {
+        skewed.insert(key, "value_" + std::to_string(key));
+        for (int i = 0; i < 40 - 10 * key; ++i) {
+            skewed.search(key, value);
+        }
+    }
+    std::vector<std::pair<int, uint32_t>> hot = skewed.hotKeys();
+    if (hot.size() != 4 || hot.front().first != 0) ++errors;
+    for (size_t i = 1; i < hot.size(); ++i) {
+        if (hot[i - 1].second < hot[i].second) ++errors;
+    }
+
+    std::cout << "Hot-key cache: " << (errors == 0 ? "passed" : std::to_string(errors) + " mismatches") << std::endl;
+    return errors == 0;
+}
 
 int main() {
+    int failures = 0;
+    failures += !testPartitionedSkipList();
+    failures += !testMissFilter();
+    failures += !testCompaction();
+    failures += !testHotKeyCache();
+
     SkipList<int, std::string> skipList(16); // Increased max level for stress testing
 
     std::cout << "Inserting initial elements..." << std::endl;
@@ -113,6 +386,10 @@ int main() {
     skipList.cleanupExpiredNodes();
     skipList.display();
 
+    if (failures > 0) {
+        std::cout << "\n" << failures << " check(s) failed!" << std::endl;
+        return 1;
+    }
     std::cout << "\nStress tests completed. No errors detected!" << std::endl;
 
     return 0;